@@ -8,8 +8,9 @@
 
 using namespace std;
 
-// Forward declaration
+// Forward declarations
 class SymbolTableManager;
+class FlatBuilder; // lowers the tree to the flat layout (FlatAST.h)
 
 // Wrapper class for values
 struct WrapperValue {
@@ -56,6 +57,7 @@ public:
 
 // --- Nodes for Literals ---
 class ConstNode : public ASTNode {
+    friend class FlatBuilder;
     WrapperValue val;
 public:
     ConstNode(WrapperValue v) : val(v) { dataType = v.type; }
@@ -64,6 +66,7 @@ public:
 
 // --- Node for Identifiers ---
 class IdNode : public ASTNode {
+    friend class FlatBuilder;
     string name;
 public:
     IdNode(string n, string t) : name(n) { dataType = t; }
@@ -86,6 +89,7 @@ public:
 
 // --- Node for Field Access (obj.field) ---
 class FieldAccessNode : public ASTNode {
+    friend class FlatBuilder;
     string objName;
     string fieldName;
 public:
@@ -118,6 +122,7 @@ public:
 // This is used for function bodies: the variable was already declared at parse time
 // for semantic checking, but at runtime we need to declare it in the CALL scope
 class VarDeclNodeRuntime : public ASTNode {
+    friend class FlatBuilder;
     string varName;
     string varType;
     ASTNode* initExpr;
@@ -159,6 +164,7 @@ public:
 
 // --- Node for Assignments ---
 class AssignNode : public ASTNode {
+    friend class FlatBuilder;
     string varName;
     ASTNode* expr;
 public:
@@ -185,6 +191,7 @@ public:
 
 // --- Node for Field Assignment (obj.field = expr) ---
 class FieldAssignNode : public ASTNode {
+    friend class FlatBuilder;
     string objName;
     string fieldName;
     ASTNode* expr;
@@ -217,6 +224,7 @@ public:
 
 // --- Node for Return Statement ---
 class ReturnNode : public ASTNode {
+    friend class FlatBuilder;
     ASTNode* expr;
 public:
     ReturnNode(ASTNode* e) : expr(e) { 
@@ -239,6 +247,7 @@ public:
 
 // --- Node for Print ---
 class PrintNode : public ASTNode {
+    friend class FlatBuilder;
     ASTNode* expr;
 public:
     PrintNode(ASTNode* e) : expr(e) { dataType = "BLACK"; }
@@ -256,6 +265,7 @@ public:
 
 // --- Node for Function Calls - Executes function bodies ---
 class FunctionCallNode : public ASTNode {
+    friend class FlatBuilder;
     string funcName;
     vector<ASTNode*> arguments;
     vector<string> paramNames;
@@ -321,6 +331,7 @@ public:
 
 // --- Specialized Binary Nodes ---
 class AddNode : public ASTNode {
+    friend class FlatBuilder;
     ASTNode *left, *right;
 public:
     AddNode(ASTNode* l, ASTNode* r) : left(l), right(r) { dataType = l->dataType; }
@@ -336,6 +347,7 @@ public:
 };
 
 class SubNode : public ASTNode {
+    friend class FlatBuilder;
     ASTNode *left, *right;
 public:
     SubNode(ASTNode* l, ASTNode* r) : left(l), right(r) { dataType = l->dataType; }
@@ -350,6 +362,7 @@ public:
 };
 
 class MulNode : public ASTNode {
+    friend class FlatBuilder;
     ASTNode *left, *right;
 public:
     MulNode(ASTNode* l, ASTNode* r) : left(l), right(r) { dataType = l->dataType; }
@@ -364,6 +377,7 @@ public:
 };
 
 class DivNode : public ASTNode {
+    friend class FlatBuilder;
     ASTNode *left, *right;
 public:
     DivNode(ASTNode* l, ASTNode* r) : left(l), right(r) { dataType = l->dataType; }
@@ -391,6 +405,7 @@ public:
 
 // Logic/Compare Node
 class LogicNode : public ASTNode {
+    friend class FlatBuilder;
     ASTNode *left, *right;
     string opName; // "AND", "OR", "EQ", "NEQ", "LT", "GT", "LE", "GE"
 public:
@@ -438,4 +453,18 @@ public:
     ~LogicNode() { delete left; delete right; }
 };
 
+// Free all function bodies stored in the manager
+// (done here where ASTNode is fully defined)
+inline void freeFunctionBodies(SymbolTableManager* mgr) {
+    for (auto* body : mgr->getFuncBodies()) {
+        if (body) {
+            for (auto* node : *body) {
+                delete node;
+            }
+            delete body;
+        }
+    }
+    mgr->getFuncBodies().clear();
+}
+
 #endif
\ No newline at end of file
@@ -0,0 +1,252 @@
+#ifndef ENGINE_H
+#define ENGINE_H
+
+#include "SymTable.h"
+#include "AST.h"
+#include "FlatAST.h"
+#include <string>
+#include <vector>
+#include <map>
+#include <array>
+
+using namespace std;
+
+// Parser globals (defined in limbaj.tab.c, link against libkub.a)
+extern int yyparse();
+extern SymbolTableManager* manager;
+extern bool hasErrors;
+extern vector<string>* errorLog;
+
+// Flex buffer API (defined in lex.yy.c)
+typedef struct yy_buffer_state* YY_BUFFER_STATE;
+extern YY_BUFFER_STATE yy_scan_string(const char* str);
+extern void yy_delete_buffer(YY_BUFFER_STATE buffer);
+
+// Resolved handle to a compiled function (see KubEngine::function()).
+// Valid until the next compile() or until the engine is destroyed.
+struct KubFunction {
+    SymbolInfo* info = nullptr;
+    SymbolTable* scope = nullptr; // reused "<name>_call" scope, parent = Global
+    int flatIndex = -1;           // index in the FlatProgram, -1 if not lowered
+};
+
+// Embeddable KUB engine: compile source once, then call its functions
+// by name as many times as needed without re-running the compiler.
+//
+//   KubEngine kub;
+//   if (kub.compile("BOI add(BOI a, BOI b) { YEET a + b; }")) {
+//       WrapperValue r = kub.call("add", 2, 3);   // r.type == "BOI", r.intVal == 5
+//   }
+//
+// For hot paths resolve the function once and call through the handle:
+//
+//   const KubFunction* add = kub.function("add");
+//   kub.call(add, 2, 3);
+//
+// A program given to the engine doesn't need a THE_OP block; if it has one,
+// it is executed once during compile(), same as in the compiler.
+//
+// setFlatAST(true) runs calls on the flat, index-based layout (FlatAST.h)
+// instead of walking the ASTNode tree. Results are the same.
+class KubEngine {
+    SymbolTableManager* mgr = nullptr;
+    string error;
+    bool useFlat = false;
+    bool flatBuilt = false;
+    FlatProgram flat;
+    map<string, KubFunction> functions;
+
+    void reset() {
+        flatBuilt = false;
+        flat = FlatProgram();
+        for (auto& [name, fn] : functions) {
+            delete fn.scope;
+        }
+        functions.clear();
+        if (mgr) {
+            freeFunctionBodies(mgr);
+            delete mgr;
+            mgr = nullptr;
+        }
+    }
+
+    // Native value -> WrapperValue
+    static WrapperValue toWrapper(const WrapperValue& v) { return v; }
+    static WrapperValue toWrapper(int v) { return WrapperValue::createInt(v); }
+    static WrapperValue toWrapper(float v) { return WrapperValue::createFloat(v); }
+    static WrapperValue toWrapper(double v) { return WrapperValue::createFloat((float)v); }
+    static WrapperValue toWrapper(bool v) { return WrapperValue::createBool(v); }
+    static WrapperValue toWrapper(const char* v) { return WrapperValue::createString(v); }
+    static WrapperValue toWrapper(const string& v) { return WrapperValue::createString(v); }
+
+    WrapperValue fail(string msg) {
+        error = msg;
+        return WrapperValue::createDefault("ERROR");
+    }
+
+    void buildFlat() {
+        flat.build(mgr);
+        for (auto& [name, fn] : functions) {
+            fn.flatIndex = flat.find(name);
+        }
+        flatBuilt = true;
+    }
+
+    // Shared implementation of every call() overload
+    WrapperValue invoke(const KubFunction* fn, const WrapperValue* args, size_t count) {
+        if (!mgr) return fail("No program compiled");
+        if (!fn) return fail("Function not defined!");
+
+        SymbolInfo* func = fn->info;
+        if (func->paramTypes.size() != count) {
+            return fail("Function '" + func->name + "' expects " + to_string(func->paramTypes.size()) +
+                        " arguments, but got " + to_string(count));
+        }
+        for (size_t i = 0; i < count; i++) {
+            if (func->paramTypes[i] != args[i].type) {
+                return fail("Arg " + to_string(i+1) + " type mismatch: expected " +
+                            func->paramTypes[i] + ", got " + args[i].type);
+            }
+        }
+        error.clear();
+
+        WrapperValue result = WrapperValue::createDefault(func->type);
+        if (!func->funcBody) return result;
+
+        mgr->currentScope = fn->scope;
+
+        for (size_t i = 0; i < count; i++) {
+            SymbolInfo* param = fn->scope->addOrGetSymbol(func->paramNames[i], func->paramTypes[i], "parameter");
+            if (param->type == "BOI") param->value = to_string(args[i].intVal);
+            else if (param->type == "WIGGLY") param->value = to_string(args[i].floatVal);
+            else if (param->type == "YAP") param->value = args[i].strVal;
+            else if (param->type == "TRUTHMODE") param->value = args[i].boolVal ? "1" : "0";
+        }
+
+        // Functions the flat program doesn't have fall back to the tree walker
+        if (useFlat && fn->flatIndex >= 0) {
+            FlatValue ret;
+            if (flat.runBody(fn->flatIndex, mgr, ret)) {
+                result = ret.toWrapper(flat.getClassTypes());
+            }
+        } else {
+            for (ASTNode* stmt : *(func->funcBody)) {
+                if (stmt) {
+                    WrapperValue stmtResult = stmt->eval(mgr);
+                    if (stmtResult.isReturn) {
+                        result = stmtResult;
+                        result.isReturn = false;
+                        break;
+                    }
+                }
+            }
+        }
+
+        // Empty the call scope so repeated calls don't grow the scope tree
+        fn->scope->clear();
+        mgr->currentScope = mgr->globalScope;
+        return result;
+    }
+
+public:
+    KubEngine() {}
+    KubEngine(const KubEngine&) = delete;
+    KubEngine& operator=(const KubEngine&) = delete;
+    ~KubEngine() { reset(); }
+
+    // Compile source held in memory. Replaces anything compiled before.
+    // Returns false on syntax/semantic errors; lastError() then holds the
+    // parser's messages, one per line.
+    bool compile(const string& source) {
+        reset();
+        error = "";
+
+        mgr = new SymbolTableManager();
+        SymbolTableManager* savedManager = manager;
+        manager = mgr;
+        hasErrors = false;
+        vector<string> messages;
+        errorLog = &messages;
+
+        YY_BUFFER_STATE buffer = yy_scan_string(source.c_str());
+        int status = yyparse();
+        yy_delete_buffer(buffer);
+
+        errorLog = nullptr;
+        manager = savedManager;
+
+        if (status != 0 || hasErrors) {
+            reset();
+            for (auto& m : messages) {
+                if (!error.empty()) error += "\n";
+                error += m;
+            }
+            if (error.empty()) error = "Compilation failed";
+            return false;
+        }
+
+        // Each function gets one call scope, reused (and cleared) by every call
+        for (auto& [name, info] : mgr->globalScope->symbols) {
+            if (info.scopeCategory == "function") {
+                KubFunction fn;
+                fn.info = &info;
+                fn.scope = new SymbolTable(name + "_call", mgr->globalScope);
+                functions[name] = fn;
+            }
+        }
+
+        if (useFlat) buildFlat();
+        return true;
+    }
+
+    // Switch between the tree walker and the flat walker
+    void setFlatAST(bool on) {
+        if (on && !flatBuilt && mgr) buildFlat();
+        useFlat = on;
+    }
+
+    bool usesFlatAST() const { return useFlat; }
+    const FlatProgram& flatProgram() const { return flat; }
+
+    bool isCompiled() const { return mgr != nullptr; }
+    const string& lastError() const { return error; }
+    SymbolTableManager* symbols() { return mgr; }
+
+    // Resolve a global function once; nullptr if there is no such function
+    const KubFunction* function(const string& name) const {
+        auto it = functions.find(name);
+        return it != functions.end() ? &it->second : nullptr;
+    }
+
+    // Call a resolved function. On error the result has type "ERROR"
+    // and lastError() describes the problem.
+    WrapperValue call(const KubFunction* fn, const vector<WrapperValue>& args) {
+        return invoke(fn, args.data(), args.size());
+    }
+
+    // Call a global function by name (one map lookup per call)
+    WrapperValue call(const string& name, const vector<WrapperValue>& args) {
+        if (!mgr) return fail("No program compiled");
+        const KubFunction* fn = function(name);
+        if (!fn) return fail("Function '" + name + "' not defined!");
+        return invoke(fn, args.data(), args.size());
+    }
+
+    // Convenience overloads taking native C++ values (int, float, bool, string)
+    template <typename... Args>
+    WrapperValue call(const KubFunction* fn, Args... args) {
+        array<WrapperValue, sizeof...(Args)> values = { toWrapper(args)... };
+        return invoke(fn, values.data(), values.size());
+    }
+
+    template <typename... Args>
+    WrapperValue call(const string& name, Args... args) {
+        if (!mgr) return fail("No program compiled");
+        const KubFunction* fn = function(name);
+        if (!fn) return fail("Function '" + name + "' not defined!");
+        array<WrapperValue, sizeof...(Args)> values = { toWrapper(args)... };
+        return invoke(fn, values.data(), values.size());
+    }
+};
+
+#endif
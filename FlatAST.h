@@ -0,0 +1,583 @@
+#ifndef FLAT_AST_H
+#define FLAT_AST_H
+
+#include "SymTable.h"
+#include "AST.h"
+#include <string>
+#include <vector>
+#include <map>
+#include <cstdint>
+#include <cstring>
+
+using namespace std;
+
+// Flat, index-based alternative to the ASTNode pointer tree.
+//
+// Every function body is lowered into one contiguous array of fixed-size
+// FlatNode records. Children are referenced by 32-bit indices into that
+// array, types and operators are packed into one-byte tags, and names and
+// string literals live in a per-function string pool. Evaluation is a
+// switch over the op tag instead of a virtual call per node.
+//
+// Runtime behaviour is the same as the tree: variables still live in the
+// SymbolTableManager, calls still open a "<name>_call" scope.
+
+// Semantic type tag ("BOI", ...). Class types get tags Class, Class+1, ...
+// in order of first use; their names are kept in FlatProgram's type table.
+enum class FlatType : uint8_t { Int, Float, String, Bool, Void, Error, Class };
+
+enum class FlatOp : uint8_t {
+    Const, Id, Field, VarDecl, Other,
+    Assign, FieldAssign, Return, Print, Call,
+    Add, Sub, Mul, Div,
+    And, Or, Eq, Neq, Lt, Gt, Le, Ge
+};
+
+// Class types take the tags from FlatType::Class up to 0xFF
+const size_t FLAT_MAX_CLASS_TYPES = 0x100 - (size_t)FlatType::Class;
+
+// Registers class types in classTypes as needed. Past FLAT_MAX_CLASS_TYPES
+// there is no tag left; build() then drops the lowered program.
+inline FlatType flatTypeOf(const string& t, vector<string>& classTypes) {
+    if (t == "BOI") return FlatType::Int;
+    if (t == "WIGGLY") return FlatType::Float;
+    if (t == "YAP") return FlatType::String;
+    if (t == "TRUTHMODE") return FlatType::Bool;
+    if (t == "BLACK") return FlatType::Void;
+    if (t == "ERROR") return FlatType::Error;
+
+    size_t first = (size_t)FlatType::Class;
+    for (size_t i = 0; i < classTypes.size(); i++) {
+        if (classTypes[i] == t) return (FlatType)(first + i);
+    }
+    classTypes.push_back(t);
+    if (classTypes.size() > FLAT_MAX_CLASS_TYPES) return FlatType::Error;
+    return (FlatType)(first + classTypes.size() - 1);
+}
+
+inline string flatTypeName(FlatType t, const vector<string>& classTypes) {
+    switch (t) {
+        case FlatType::Int: return "BOI";
+        case FlatType::Float: return "WIGGLY";
+        case FlatType::String: return "YAP";
+        case FlatType::Bool: return "TRUTHMODE";
+        case FlatType::Void: return "BLACK";
+        case FlatType::Error: return "ERROR";
+        default: return classTypes[(size_t)t - (size_t)FlatType::Class];
+    }
+}
+
+const uint32_t FLAT_NONE = 0xFFFFFFFFu;
+
+// One node, 16 bytes. Meaning of a/b/c depends on op:
+//   Const       a = int/float bits, bool, or string index
+//   Id          a = name
+//   Field       a = object name, b = field name
+//   VarDecl     a = name, b = type name, c = init expr (or FLAT_NONE)
+//   Assign      a = name, b = expr
+//   FieldAssign a = object name, b = field name, c = expr
+//   Return      a = expr (or FLAT_NONE)
+//   Print       a = expr
+//   Call        a = callee function (or FLAT_NONE), b = first arg in operands, c = arg count
+//   Add..Ge     a = left, b = right (operandType = type of left)
+struct FlatNode {
+    FlatOp op;
+    FlatType type;        // dataType of the tree node
+    FlatType operandType; // only used by comparisons
+    uint8_t unused = 0;
+    uint32_t a = FLAT_NONE;
+    uint32_t b = FLAT_NONE;
+    uint32_t c = FLAT_NONE;
+};
+
+static_assert(sizeof(FlatNode) == 16, "FlatNode must stay 16 bytes");
+
+struct FlatFunction {
+    string name;
+    string callScopeName;
+    vector<string> paramNames;
+    vector<string> paramTypes;
+
+    vector<FlatNode> nodes;   // children always come before their parent
+    vector<uint32_t> operands; // call arguments
+    vector<uint32_t> body;    // statement roots, in order
+    vector<string> strings;   // names, type names and string literals
+
+    size_t memoryBytes() const {
+        size_t bytes = sizeof(FlatFunction)
+            + nodes.capacity() * sizeof(FlatNode)
+            + operands.capacity() * sizeof(uint32_t)
+            + body.capacity() * sizeof(uint32_t)
+            + strings.capacity() * sizeof(string);
+        for (auto& s : strings) {
+            if (s.capacity() > 15) bytes += s.capacity() + 1;
+        }
+        return bytes;
+    }
+};
+
+// Value produced by the flat walker. Keeps every field like WrapperValue,
+// since the tree reads e.g. boolVal of an int operand in AND/OR.
+struct FlatValue {
+    FlatType type = FlatType::Void;
+    bool boolVal = false;
+    int intVal = 0;
+    float floatVal = 0.0;
+    string strVal;
+
+    static FlatValue of(FlatType t) { FlatValue v; v.type = t; return v; }
+
+    WrapperValue toWrapper(const vector<string>& classTypes) const {
+        WrapperValue w = WrapperValue::createDefault(flatTypeName(type, classTypes));
+        w.intVal = intVal;
+        w.floatVal = floatVal;
+        w.strVal = strVal;
+        w.boolVal = boolVal;
+        return w;
+    }
+};
+
+// Tree vs flat size, filled in by FlatProgram::build()
+struct FlatStats {
+    size_t treeNodes = 0;
+    size_t treeAllocs = 0;  // separate heap blocks (nodes, strings, vectors)
+    size_t treeBytes = 0;
+    size_t flatNodes = 0;
+    size_t flatBytes = 0;
+};
+
+// Lowers one function body from the pointer tree into a FlatFunction
+class FlatBuilder {
+    FlatFunction& fn;
+    const map<string, uint32_t>& functionIndex;
+    map<string, uint32_t> stringIndex;
+    vector<string>& classTypes;
+    FlatStats& stats;
+
+    void countString(const string& s) {
+        if (s.capacity() > 15) { stats.treeAllocs++; stats.treeBytes += s.capacity() + 1; }
+    }
+
+    void countNode(ASTNode* node, size_t size) {
+        stats.treeNodes++;
+        stats.treeAllocs++;
+        stats.treeBytes += size;
+        countString(node->dataType);
+    }
+
+    uint32_t str(const string& s) {
+        auto it = stringIndex.find(s);
+        if (it != stringIndex.end()) return it->second;
+        fn.strings.push_back(s);
+        uint32_t idx = fn.strings.size() - 1;
+        stringIndex[s] = idx;
+        return idx;
+    }
+
+    uint32_t emit(FlatOp op, ASTNode* node, uint32_t a = FLAT_NONE, uint32_t b = FLAT_NONE, uint32_t c = FLAT_NONE) {
+        FlatNode n;
+        n.op = op;
+        n.type = flatTypeOf(node->dataType, classTypes);
+        n.operandType = n.type;
+        n.a = a;
+        n.b = b;
+        n.c = c;
+        fn.nodes.push_back(n);
+        return fn.nodes.size() - 1;
+    }
+
+    // Stands in for statements the tree evaluates to WrapperValue()
+    uint32_t voidNode(ASTNode* node) {
+        uint32_t idx = emit(FlatOp::Other, node);
+        fn.nodes[idx].type = FlatType::Void;
+        return idx;
+    }
+
+    uint32_t binary(FlatOp op, ASTNode* node, ASTNode* left, ASTNode* right) {
+        uint32_t l = lower(left);
+        uint32_t r = lower(right);
+        uint32_t idx = emit(op, node, l, r);
+        fn.nodes[idx].operandType = flatTypeOf(left->dataType, classTypes);
+        return idx;
+    }
+
+public:
+    FlatBuilder(FlatFunction& f, const map<string, uint32_t>& functions, vector<string>& classes, FlatStats& s)
+        : fn(f), functionIndex(functions), classTypes(classes), stats(s) {}
+
+    uint32_t lower(ASTNode* node) {
+        if (auto n = dynamic_cast<ConstNode*>(node)) {
+            countNode(node, sizeof(ConstNode));
+            countString(n->val.type);
+            countString(n->val.strVal);
+            uint32_t payload = 0;
+            if (n->val.type == "BOI") payload = (uint32_t)n->val.intVal;
+            else if (n->val.type == "WIGGLY") memcpy(&payload, &n->val.floatVal, sizeof(float));
+            else if (n->val.type == "TRUTHMODE") payload = n->val.boolVal ? 1 : 0;
+            else if (n->val.type == "YAP") payload = str(n->val.strVal);
+            return emit(FlatOp::Const, node, payload);
+        }
+        if (auto n = dynamic_cast<IdNode*>(node)) {
+            countNode(node, sizeof(IdNode));
+            countString(n->name);
+            return emit(FlatOp::Id, node, str(n->name));
+        }
+        if (auto n = dynamic_cast<FieldAccessNode*>(node)) {
+            countNode(node, sizeof(FieldAccessNode));
+            countString(n->objName);
+            countString(n->fieldName);
+            return emit(FlatOp::Field, node, str(n->objName), str(n->fieldName));
+        }
+        if (auto n = dynamic_cast<VarDeclNodeRuntime*>(node)) {
+            countNode(node, sizeof(VarDeclNodeRuntime));
+            countString(n->varName);
+            countString(n->varType);
+            uint32_t init = n->initExpr ? lower(n->initExpr) : FLAT_NONE;
+            return emit(FlatOp::VarDecl, node, str(n->varName), str(n->varType), init);
+        }
+        if (auto n = dynamic_cast<AssignNode*>(node)) {
+            countNode(node, sizeof(AssignNode));
+            countString(n->varName);
+            if (!n->expr) return voidNode(node);
+            uint32_t e = lower(n->expr);
+            return emit(FlatOp::Assign, node, str(n->varName), e);
+        }
+        if (auto n = dynamic_cast<FieldAssignNode*>(node)) {
+            countNode(node, sizeof(FieldAssignNode));
+            countString(n->objName);
+            countString(n->fieldName);
+            if (!n->expr) return voidNode(node);
+            uint32_t e = lower(n->expr);
+            return emit(FlatOp::FieldAssign, node, str(n->objName), str(n->fieldName), e);
+        }
+        if (auto n = dynamic_cast<ReturnNode*>(node)) {
+            countNode(node, sizeof(ReturnNode));
+            uint32_t e = n->expr ? lower(n->expr) : FLAT_NONE;
+            return emit(FlatOp::Return, node, e);
+        }
+        if (auto n = dynamic_cast<PrintNode*>(node)) {
+            countNode(node, sizeof(PrintNode));
+            uint32_t e = n->expr ? lower(n->expr) : FLAT_NONE;
+            return emit(FlatOp::Print, node, e);
+        }
+        if (auto n = dynamic_cast<FunctionCallNode*>(node)) {
+            countNode(node, sizeof(FunctionCallNode));
+            countString(n->funcName);
+            stats.treeAllocs += (n->arguments.capacity() > 0) + (n->paramNames.capacity() > 0);
+            stats.treeBytes += n->arguments.capacity() * sizeof(ASTNode*) + n->paramNames.capacity() * sizeof(string);
+            for (auto& p : n->paramNames) countString(p);
+
+            vector<uint32_t> args;
+            for (ASTNode* arg : n->arguments) args.push_back(lower(arg));
+            uint32_t first = fn.operands.size();
+            fn.operands.insert(fn.operands.end(), args.begin(), args.end());
+
+            // Bind to the global function; call() still checks at runtime
+            // that the name isn't hidden by a variable
+            auto it = functionIndex.find(n->funcName);
+            uint32_t callee = it != functionIndex.end() ? it->second : FLAT_NONE;
+            return emit(FlatOp::Call, node, callee, first, args.size());
+        }
+        if (auto n = dynamic_cast<AddNode*>(node)) {
+            countNode(node, sizeof(AddNode));
+            return binary(FlatOp::Add, node, n->left, n->right);
+        }
+        if (auto n = dynamic_cast<SubNode*>(node)) {
+            countNode(node, sizeof(SubNode));
+            return binary(FlatOp::Sub, node, n->left, n->right);
+        }
+        if (auto n = dynamic_cast<MulNode*>(node)) {
+            countNode(node, sizeof(MulNode));
+            return binary(FlatOp::Mul, node, n->left, n->right);
+        }
+        if (auto n = dynamic_cast<DivNode*>(node)) {
+            countNode(node, sizeof(DivNode));
+            return binary(FlatOp::Div, node, n->left, n->right);
+        }
+        if (auto n = dynamic_cast<LogicNode*>(node)) {
+            countNode(node, sizeof(LogicNode));
+            countString(n->opName);
+            FlatOp op = FlatOp::And;
+            if (n->opName == "OR") op = FlatOp::Or;
+            else if (n->opName == "EQ") op = FlatOp::Eq;
+            else if (n->opName == "NEQ") op = FlatOp::Neq;
+            else if (n->opName == "LT") op = FlatOp::Lt;
+            else if (n->opName == "GT") op = FlatOp::Gt;
+            else if (n->opName == "LE") op = FlatOp::Le;
+            else if (n->opName == "GE") op = FlatOp::Ge;
+            return binary(op, node, n->left, n->right);
+        }
+        // OtherNode (and anything unknown) just yields a default value
+        countNode(node, sizeof(OtherNode));
+        return emit(FlatOp::Other, node);
+    }
+};
+
+// All global functions of a compiled program, in flat form
+class FlatProgram {
+    vector<FlatFunction> functions;
+    map<string, uint32_t> functionIndex;
+    vector<string> classTypes;
+    FlatStats stats;
+
+    static FlatValue load(const string& value, FlatType t) {
+        FlatValue v = FlatValue::of(t);
+        if (t == FlatType::Int) v.intVal = value.empty() ? 0 : stoi(value);
+        else if (t == FlatType::Float) v.floatVal = value.empty() ? 0.0 : stof(value);
+        else if (t == FlatType::String) v.strVal = value;
+        else if (t == FlatType::Bool) v.boolVal = (value == "1");
+        return v;
+    }
+
+    static void store(SymbolInfo* s, const FlatValue& v) {
+        if (s->type == "BOI") s->value = to_string(v.intVal);
+        else if (s->type == "WIGGLY") s->value = to_string(v.floatVal);
+        else if (s->type == "YAP") s->value = v.strVal;
+        else if (s->type == "TRUTHMODE") s->value = v.boolVal ? "1" : "0";
+    }
+
+    static SymbolInfo* findField(SymbolTableManager* mgr, const string& objName, const string& fieldName) {
+        SymbolInfo* obj = mgr->getSymbol(objName);
+        if (!obj) return nullptr;
+        SymbolTable* classScope = mgr->findClassScope(obj->type);
+        if (!classScope) return nullptr;
+        return classScope->findSymbolLocal(fieldName);
+    }
+
+    FlatValue call(const FlatFunction& caller, const FlatNode& n, SymbolTableManager* mgr) {
+        if (n.a == FLAT_NONE) return FlatValue::of(n.type);
+        const FlatFunction& f = functions[n.a];
+
+        // Like FunctionCallNode, resolve the name in the caller's scope first:
+        // a local or parameter with the same name hides the global function
+        SymbolInfo* s = mgr->getSymbol(f.name);
+        if (!s || !s->funcBody) return FlatValue::of(n.type);
+
+        mgr->enterScope(f.callScopeName);
+        // Same order as FunctionCallNode: each argument is evaluated after
+        // the previous parameters were declared in the call scope
+        for (uint32_t i = 0; i < n.c && i < f.paramNames.size(); i++) {
+            FlatValue argVal = eval(caller, caller.operands[n.b + i], mgr);
+            mgr->declareVariable(f.paramNames[i], f.paramTypes[i], "parameter");
+            SymbolInfo* param = mgr->getSymbol(f.paramNames[i]);
+            if (param) store(param, argVal);
+        }
+
+        FlatValue result = FlatValue::of(n.type);
+        runBody(n.a, mgr, result);
+        mgr->exitScope();
+        return result;
+    }
+
+public:
+    // Lower every global function that has a body
+    void build(SymbolTableManager* mgr) {
+        functions.clear();
+        functionIndex.clear();
+        classTypes.clear();
+        stats = FlatStats();
+
+        vector<SymbolInfo*> sources;
+        for (auto& [name, info] : mgr->globalScope->symbols) {
+            if (info.scopeCategory == "function" && info.funcBody) {
+                functionIndex[name] = functions.size();
+                FlatFunction f;
+                f.name = name;
+                f.callScopeName = name + "_call";
+                f.paramNames = info.paramNames;
+                f.paramTypes = info.paramTypes;
+                functions.push_back(f);
+                sources.push_back(&info);
+            }
+        }
+
+        for (size_t i = 0; i < functions.size(); i++) {
+            FlatFunction& f = functions[i];
+            vector<ASTNode*>* body = sources[i]->funcBody;
+            stats.treeAllocs++;
+            stats.treeBytes += sizeof(vector<ASTNode*>) + body->capacity() * sizeof(ASTNode*);
+
+            FlatBuilder builder(f, functionIndex, classTypes, stats);
+            for (ASTNode* stmt : *body) {
+                if (stmt) f.body.push_back(builder.lower(stmt));
+            }
+            f.nodes.shrink_to_fit();
+            f.operands.shrink_to_fit();
+            f.body.shrink_to_fit();
+            f.strings.shrink_to_fit();
+
+            stats.flatNodes += f.nodes.size();
+            stats.flatBytes += f.memoryBytes();
+        }
+
+        // Out of class tags: leave the program unlowered, so find() fails
+        // and every call runs on the tree walker
+        if (classTypes.size() > FLAT_MAX_CLASS_TYPES) {
+            functions.clear();
+            functionIndex.clear();
+            classTypes.clear();
+            stats.flatNodes = 0;
+            stats.flatBytes = 0;
+        }
+    }
+
+    int find(const string& name) const {
+        auto it = functionIndex.find(name);
+        return it != functionIndex.end() ? (int)it->second : -1;
+    }
+
+    const FlatFunction& function(uint32_t idx) const { return functions[idx]; }
+    const FlatStats& getStats() const { return stats; }
+    const vector<string>& getClassTypes() const { return classTypes; }
+
+    // Execute the body of a function in the current scope.
+    // Returns true (and sets ret) if a YEET was executed.
+    bool runBody(uint32_t fnIdx, SymbolTableManager* mgr, FlatValue& ret) {
+        const FlatFunction& f = functions[fnIdx];
+        for (uint32_t root : f.body) {
+            FlatValue v = eval(f, root, mgr);
+            if (f.nodes[root].op == FlatOp::Return) {
+                ret = v;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    FlatValue eval(const FlatFunction& fn, uint32_t idx, SymbolTableManager* mgr) {
+        const FlatNode& n = fn.nodes[idx];
+        switch (n.op) {
+            case FlatOp::Const: {
+                FlatValue v = FlatValue::of(n.type);
+                if (n.type == FlatType::Int) v.intVal = (int)n.a;
+                else if (n.type == FlatType::Float) memcpy(&v.floatVal, &n.a, sizeof(float));
+                else if (n.type == FlatType::Bool) v.boolVal = n.a != 0;
+                else if (n.type == FlatType::String) v.strVal = fn.strings[n.a];
+                return v;
+            }
+            case FlatOp::Id: {
+                SymbolInfo* s = mgr->getSymbol(fn.strings[n.a]);
+                if (!s) return FlatValue();
+                return load(s->value, n.type);
+            }
+            case FlatOp::Field: {
+                SymbolInfo* field = findField(mgr, fn.strings[n.a], fn.strings[n.b]);
+                if (!field) return FlatValue::of(n.type);
+                return load(field->value, n.type);
+            }
+            case FlatOp::VarDecl: {
+                mgr->declareVariable(fn.strings[n.a], fn.strings[n.b], "variable");
+                if (n.c != FLAT_NONE) {
+                    FlatValue v = eval(fn, n.c, mgr);
+                    SymbolInfo* s = mgr->getSymbol(fn.strings[n.a]);
+                    if (s) store(s, v);
+                }
+                return FlatValue();
+            }
+            case FlatOp::Other:
+                return FlatValue::of(n.type);
+            case FlatOp::Assign: {
+                FlatValue v = eval(fn, n.b, mgr);
+                SymbolInfo* s = mgr->getSymbol(fn.strings[n.a]);
+                if (s) store(s, v);
+                return v;
+            }
+            case FlatOp::FieldAssign: {
+                FlatValue v = eval(fn, n.c, mgr);
+                SymbolInfo* field = findField(mgr, fn.strings[n.a], fn.strings[n.b]);
+                if (field) store(field, v);
+                return v;
+            }
+            case FlatOp::Return:
+                return n.a != FLAT_NONE ? eval(fn, n.a, mgr) : FlatValue();
+            case FlatOp::Print: {
+                if (n.a != FLAT_NONE) {
+                    FlatValue v = eval(fn, n.a, mgr);
+                    cout << "[PRINT OUTPUT]: ";
+                    v.toWrapper(classTypes).print();
+                    cout << endl;
+                }
+                return FlatValue();
+            }
+            case FlatOp::Call:
+                return call(fn, n, mgr);
+            default:
+                break;
+        }
+
+        // Binary operators
+        FlatValue l = eval(fn, n.a, mgr);
+        FlatValue r = eval(fn, n.b, mgr);
+        FlatValue res;
+        switch (n.op) {
+            case FlatOp::Add:
+                if (n.type == FlatType::Int) { res.type = n.type; res.intVal = l.intVal + r.intVal; }
+                else if (n.type == FlatType::Float) { res.type = n.type; res.floatVal = l.floatVal + r.floatVal; }
+                else if (n.type == FlatType::String) { res.type = n.type; res.strVal = l.strVal + r.strVal; }
+                return res;
+            case FlatOp::Sub:
+                if (n.type == FlatType::Int) { res.type = n.type; res.intVal = l.intVal - r.intVal; }
+                else if (n.type == FlatType::Float) { res.type = n.type; res.floatVal = l.floatVal - r.floatVal; }
+                return res;
+            case FlatOp::Mul:
+                if (n.type == FlatType::Int) { res.type = n.type; res.intVal = l.intVal * r.intVal; }
+                else if (n.type == FlatType::Float) { res.type = n.type; res.floatVal = l.floatVal * r.floatVal; }
+                return res;
+            case FlatOp::Div:
+                if (n.type == FlatType::Int) {
+                    res.type = n.type;
+                    if (r.intVal == 0) cerr << "Runtime Error: Division by zero!" << endl;
+                    else res.intVal = l.intVal / r.intVal;
+                }
+                else if (n.type == FlatType::Float) {
+                    res.type = n.type;
+                    if (r.floatVal == 0.0) cerr << "Runtime Error: Division by zero!" << endl;
+                    else res.floatVal = l.floatVal / r.floatVal;
+                }
+                return res;
+            default:
+                break;
+        }
+
+        // Logic/compare: result is always TRUTHMODE
+        res.type = FlatType::Bool;
+        FlatType t = n.operandType;
+        switch (n.op) {
+            case FlatOp::And: res.boolVal = l.boolVal && r.boolVal; break;
+            case FlatOp::Or: res.boolVal = l.boolVal || r.boolVal; break;
+            case FlatOp::Eq:
+                if (t == FlatType::Int) res.boolVal = (l.intVal == r.intVal);
+                else if (t == FlatType::Float) res.boolVal = (l.floatVal == r.floatVal);
+                else if (t == FlatType::Bool) res.boolVal = (l.boolVal == r.boolVal);
+                else if (t == FlatType::String) res.boolVal = (l.strVal == r.strVal);
+                break;
+            case FlatOp::Neq:
+                if (t == FlatType::Int) res.boolVal = (l.intVal != r.intVal);
+                else if (t == FlatType::Float) res.boolVal = (l.floatVal != r.floatVal);
+                else if (t == FlatType::Bool) res.boolVal = (l.boolVal != r.boolVal);
+                else if (t == FlatType::String) res.boolVal = (l.strVal != r.strVal);
+                break;
+            case FlatOp::Lt:
+                if (t == FlatType::Int) res.boolVal = (l.intVal < r.intVal);
+                else if (t == FlatType::Float) res.boolVal = (l.floatVal < r.floatVal);
+                break;
+            case FlatOp::Gt:
+                if (t == FlatType::Int) res.boolVal = (l.intVal > r.intVal);
+                else if (t == FlatType::Float) res.boolVal = (l.floatVal > r.floatVal);
+                break;
+            case FlatOp::Le:
+                if (t == FlatType::Int) res.boolVal = (l.intVal <= r.intVal);
+                else if (t == FlatType::Float) res.boolVal = (l.floatVal <= r.floatVal);
+                break;
+            case FlatOp::Ge:
+                if (t == FlatType::Int) res.boolVal = (l.intVal >= r.intVal);
+                else if (t == FlatType::Float) res.boolVal = (l.floatVal >= r.floatVal);
+                break;
+            default:
+                break;
+        }
+        return res;
+    }
+};
+
+#endif
@@ -43,14 +43,15 @@ public:
         parent = p;
     }
 
-    bool addSymbol(string name, string type, string category = "variable")
+    bool addSymbol(const string& name, const string& type, const string& category = "variable")
     {
-        if (symbols.find(name) != symbols.end())
-        {
-            return false;
-        }
-        symbols.insert({name, SymbolInfo(name, type, "", category)});
-        return true;
+        return symbols.try_emplace(name, name, type, "", category).second;
+    }
+
+    // Like addSymbol, but returns the symbol (the existing one if already declared)
+    SymbolInfo* addOrGetSymbol(const string& name, const string& type, const string& category = "variable")
+    {
+        return &symbols.try_emplace(name, name, type, "", category).first->second;
     }
 
     bool addFunctionSymbol(string name, string type, vector<string> params)
@@ -65,11 +66,12 @@ public:
         return true;
     }
 
-    SymbolInfo* findSymbol(string name)
+    SymbolInfo* findSymbol(const string& name)
     {
-        if (symbols.find(name)!= symbols.end())
+        auto it = symbols.find(name);
+        if (it != symbols.end())
         {
-            return &symbols[name];
+            return &it->second;
         }
 
         if (parent != nullptr)
@@ -80,15 +82,27 @@ public:
         return nullptr;
     }
 
-    SymbolInfo* findSymbolLocal (string name)
+    SymbolInfo* findSymbolLocal (const string& name)
     {
-        if (symbols.find(name)!= symbols.end())
+        auto it = symbols.find(name);
+        if (it != symbols.end())
         {
-            return &symbols[name];
+            return &it->second;
         }
         return nullptr;
     }
 
+    // Drop all symbols and child scopes so the table can be reused
+    void clear()
+    {
+        symbols.clear();
+        for (auto child : children)
+        {
+            delete child;
+        }
+        children.clear();
+    }
+
     void printTable(ofstream& out, int indentLevel = 0)
     {
         string indent(indentLevel * 4, ' ');
@@ -153,14 +167,14 @@ public:
         currentScope = globalScope;
     }
 
-    void enterScope(string name)
+    void enterScope(const string& name)
     {
         SymbolTable* newScope = new SymbolTable(name, currentScope);
         currentScope->children.push_back(newScope);
         currentScope = newScope;
     }
 
-    SymbolInfo* getSymbol(string name)
+    SymbolInfo* getSymbol(const string& name)
     {
         return currentScope->findSymbol(name);
     }
@@ -172,7 +186,7 @@ public:
         }
     }
 
-    bool declareVariable(string name, string type, string category = "variable")
+    bool declareVariable(const string& name, const string& type, const string& category = "variable")
     {
         return currentScope->addSymbol(name, type, category);
     }
@@ -217,7 +231,7 @@ public:
         return currentScope->findSymbol(name) != nullptr;
     }
     
-    SymbolTable* findClassScope(string className)
+    SymbolTable* findClassScope(const string& className)
     {
         for(auto child : globalScope->children)
         {
@@ -0,0 +1,54 @@
+// Per-call overhead of KubEngine::call for tiny functions.
+//
+// Build (after ./compile.sh has produced libkub.a):
+//   g++ -O2 -std=c++17 -I. bench/call_overhead_bench.cpp libkub.a -o call_overhead_bench
+//   ./call_overhead_bench
+
+#include "../Engine.h"
+#include <chrono>
+#include <cstdio>
+
+using namespace std;
+
+static const char* SOURCE =
+    "BLACK nop() { }\n"
+    "BOI id(BOI a) { YEET a; }\n"
+    "BOI add(BOI a, BOI b) { YEET a + b; }\n"
+    "WIGGLY scale(WIGGLY x, WIGGLY k) { YEET x * k; }\n"
+    "YAP greet(YAP n) { YEET \"hi \" + n; }\n";
+
+template <typename F>
+static double nsPerCall(int calls, F body) {
+    for (int i = 0; i < calls / 10; i++) body(i); // warm-up
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < calls; i++) body(i);
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double, nano>(end - start).count() / calls;
+}
+
+int main() {
+    KubEngine kub;
+    if (!kub.compile(SOURCE)) {
+        printf("compile failed: %s\n", kub.lastError().c_str());
+        return 1;
+    }
+
+    const int N = 1000000;
+    const KubFunction* nop = kub.function("nop");
+    const KubFunction* id = kub.function("id");
+    const KubFunction* add = kub.function("add");
+    const KubFunction* scale = kub.function("scale");
+    const KubFunction* greet = kub.function("greet");
+    long sink = 0;
+
+    printf("%-28s %10s\n", "call", "ns/call");
+    printf("%-28s %10.1f\n", "nop()            by name", nsPerCall(N, [&](int) { sink += kub.call("nop").intVal; }));
+    printf("%-28s %10.1f\n", "nop()            handle", nsPerCall(N, [&](int) { sink += kub.call(nop).intVal; }));
+    printf("%-28s %10.1f\n", "id(BOI)          handle", nsPerCall(N, [&](int i) { sink += kub.call(id, i).intVal; }));
+    printf("%-28s %10.1f\n", "add(BOI, BOI)    by name", nsPerCall(N, [&](int i) { sink += kub.call("add", i, 1).intVal; }));
+    printf("%-28s %10.1f\n", "add(BOI, BOI)    handle", nsPerCall(N, [&](int i) { sink += kub.call(add, i, 1).intVal; }));
+    printf("%-28s %10.1f\n", "scale(WIGGLY, WIGGLY) handle", nsPerCall(N, [&](int) { sink += (long)kub.call(scale, 1.5f, 2.0f).floatVal; }));
+    printf("%-28s %10.1f\n", "greet(YAP)       handle", nsPerCall(N, [&](int) { sink += kub.call(greet, "bob").strVal.size(); }));
+    printf("(checksum %ld)\n", sink);
+    return 0;
+}
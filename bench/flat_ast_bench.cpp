@@ -0,0 +1,433 @@
+// Tree vs flat AST: memory footprint and evaluation speed on large generated programs,
+// plus an equivalence check of both walkers over every value type.
+//
+// Build (after ./compile.sh has produced libkub.a):
+//   g++ -O2 -std=c++17 -I. bench/flat_ast_bench.cpp libkub.a -o flat_ast_bench
+//   ./flat_ast_bench
+
+#include "../Engine.h"
+#include <chrono>
+#include <random>
+#include <sstream>
+#include <cstdio>
+#include <cmath>
+
+using namespace std;
+
+// ---------------------------------------------------------------------------
+// Equivalence: random functions over BOI, WIGGLY, YAP, TRUTHMODE, a class
+// type and BLACK, with SHOUT, field access, calls between functions and
+// locals or parameters that hide a function's name.
+// ---------------------------------------------------------------------------
+
+class EquivalenceGen {
+    mt19937 rng;
+    ostringstream src;
+    // Only the first LEAVES functions are callable, and they call nothing,
+    // so nested calls stay one level deep (leaf* lists are published after them)
+    static const int LEAVES = 8;
+    vector<string> ints, floats, strings, bools, voids, classes;
+    vector<string> leafInts, leafFloats, leafStrings, leafBools, leafVoids, leafClasses;
+    // Class fields persist between calls, so field assignments must not feed
+    // strings back into themselves (p.label = p.label + p.label would double
+    // on every call): they read no fields, call nothing, and YAP fields only
+    // get literals
+    bool readFields = true;
+    const char* ARGS_DECL = "(BOI x, WIGGLY y, YAP s, TRUTHMODE t)";
+
+    bool chance(int n) { return rng() % n == 0; }
+    string lit() { return to_string(rng() % 10); }
+
+    string callArgs(int depth) {
+        return "(" + intExpr(depth) + ", " + floatExpr(depth) + ", " + strExpr(depth) + ", " + boolExpr(depth) + ")";
+    }
+
+    string pick(const vector<string>& names) { return names[rng() % names.size()]; }
+
+    string intExpr(int depth) {
+        if (depth <= 0 || chance(4)) {
+            switch (rng() % 4) {
+                case 0: return lit();
+                case 1: return readFields ? "p.px" : "x";
+                default: return "x";
+            }
+        }
+        string l = intExpr(depth - 1);
+        switch (rng() % 7) {
+            case 0: return "(" + l + " + " + intExpr(depth - 1) + ")";
+            case 1: return "(" + l + " - " + intExpr(depth - 1) + ")";
+            case 2: return "(" + to_string(rng() % 3) + " * " + l + ")";
+            case 3: return "(" + l + " / " + to_string(rng() % 9 + 1) + ")";
+            case 4: return chance(3) ? "(" + l + " / (x - x))" : l;  // division by zero
+            default:
+                if (ints.empty() || !readFields) return l;
+                return "(" + pick(ints) + callArgs(depth - 2) + " / 100)";
+        }
+    }
+
+    string floatExpr(int depth) {
+        if (depth <= 0 || chance(4)) {
+            switch (rng() % 3) {
+                case 0: return lit() + ".25";
+                case 1: return readFields ? "p.py" : "y";
+                default: return "y";
+            }
+        }
+        string l = floatExpr(depth - 1);
+        switch (rng() % 5) {
+            case 0: return "(" + l + " + " + floatExpr(depth - 1) + ")";
+            case 1: return "(" + l + " - " + floatExpr(depth - 1) + ")";
+            case 2: return "(" + l + " * 0.5)";
+            case 3: return "(" + l + " / 2.0)";
+            default:
+                if (floats.empty() || !readFields) return l;
+                return pick(floats) + callArgs(depth - 2);
+        }
+    }
+
+    string strExpr(int depth) {
+        if (depth <= 0 || chance(3) || !readFields) {
+            switch (rng() % 3) {
+                case 0: return "\"w" + lit() + "\"";
+                case 1: return readFields ? "p.label" : "\"w" + lit() + "\"";
+                default: return readFields ? "s" : "\"w" + lit() + "\"";
+            }
+        }
+        if (!strings.empty() && readFields && chance(3)) return pick(strings) + callArgs(depth - 2);
+        return "(" + strExpr(depth - 1) + " + " + strExpr(depth - 1) + ")";
+    }
+
+    string boolExpr(int depth) {
+        if (depth <= 0 || chance(5)) {
+            switch (rng() % 4) {
+                case 0: return "BASED";
+                case 1: return "CRINGE";
+                case 2: return readFields ? "p.flag" : "t";
+                default: return "t";
+            }
+        }
+        static const char* CMP[] = { " == ", " != ", " < ", " > ", " <= ", " >= " };
+        switch (rng() % 8) {
+            case 0: return "(" + intExpr(depth - 1) + CMP[rng() % 6] + intExpr(depth - 1) + ")";
+            case 1: return "(" + floatExpr(depth - 1) + CMP[rng() % 6] + floatExpr(depth - 1) + ")";
+            case 2: return "(" + strExpr(depth - 1) + CMP[rng() % 2] + strExpr(depth - 1) + ")";
+            case 3: return "(" + boolExpr(depth - 1) + CMP[rng() % 2] + boolExpr(depth - 1) + ")";
+            case 4: return "(" + boolExpr(depth - 1) + " && " + boolExpr(depth - 1) + ")";
+            case 5: return "(" + boolExpr(depth - 1) + " || " + boolExpr(depth - 1) + ")";
+            case 6: return "(" + intExpr(depth - 1) + " && " + intExpr(depth - 1) + ")";  // boolVal of ints
+            default:
+                if (bools.empty() || !readFields) return boolExpr(depth - 1);
+                return pick(bools) + callArgs(depth - 2);
+        }
+    }
+
+    string shout(int depth) {
+        switch (rng() % 7) {
+            case 0: return "    SHOUT(" + intExpr(depth) + ");\n";
+            case 1: return "    SHOUT(" + floatExpr(depth) + ");\n";
+            case 2: return "    SHOUT(" + strExpr(depth) + ");\n";
+            case 3: return "    SHOUT(" + boolExpr(depth) + ");\n";
+            case 4: return voids.empty() ? "" : "    SHOUT(" + pick(voids) + callArgs(depth - 1) + ");\n";
+            case 5: return classes.empty() ? "" : "    SHOUT(" + pick(classes) + callArgs(depth - 1) + ");\n";
+            default: return "    SHOUT(p.px);\n";
+        }
+    }
+
+    // Common prologue: a local object whose fields the body reads and writes
+    string prologue(int depth) {
+        string body = "    Pt p;\n";
+        readFields = false;
+        if (chance(2)) body += "    p.px = " + intExpr(depth) + ";\n";
+        if (chance(2)) body += "    p.py = " + floatExpr(depth) + ";\n";
+        if (chance(2)) body += "    p.label = " + strExpr(depth) + ";\n";
+        if (chance(2)) body += "    p.flag = " + boolExpr(depth) + ";\n";
+        readFields = true;
+        int n = rng() % 3;
+        for (int i = 0; i < n; i++) body += shout(depth);
+        return body;
+    }
+
+    // A relay that only calls a leaf, and a function that hides the leaf's name
+    // behind a local or a parameter before calling the relay: calls resolve
+    // the name in the caller's scope, so the leaf isn't run and the relay
+    // returns its default value
+    void shadowing(int index) {
+        vector<pair<string, string>> leaves;
+        for (auto& n : leafInts) leaves.push_back({ n, "BOI" });
+        for (auto& n : leafFloats) leaves.push_back({ n, "WIGGLY" });
+        for (auto& n : leafStrings) leaves.push_back({ n, "YAP" });
+        for (auto& n : leafBools) leaves.push_back({ n, "TRUTHMODE" });
+        for (auto& n : leafClasses) leaves.push_back({ n, "Pt" });
+        if (leaves.empty()) return;
+
+        auto [leaf, type] = leaves[rng() % leaves.size()];
+        string relay = "r" + to_string(index);
+        string caller = "h" + to_string(index);
+        src << type << " " << relay << ARGS_DECL << " {\n    YEET " << leaf << "(x, y, s, t);\n}\n";
+        if (chance(2)) {
+            src << type << " " << caller << ARGS_DECL << " {\n    BOI " << leaf << " = x;\n"
+                << "    YEET " << relay << "(x, y, s, t);\n}\n";
+        } else {
+            src << type << " " << caller << "(BOI x, WIGGLY y, YAP s, TRUTHMODE " << leaf << ") {\n"
+                << "    YEET " << relay << "(x, y, s, " << leaf << ");\n}\n";
+        }
+        functionNames.push_back(relay);
+        functionNames.push_back(caller);
+    }
+
+public:
+    vector<string> functionNames;
+
+    EquivalenceGen(unsigned seed) : rng(seed) {}
+
+    string generate(int functions, int depth) {
+        src << "PEPESSACK Pt { BOI px; WIGGLY py; YAP label; TRUTHMODE flag; };\n";
+        for (int i = 0; i < functions; i++) {
+            string name;
+            string body;
+            switch (rng() % 7) {
+                case 0:
+                    name = "i" + to_string(i);
+                    body = prologue(depth) + "    BOI r = " + intExpr(depth) + ";\n    r = r + " + intExpr(depth) + ";\n    YEET r;\n";
+                    src << "BOI " << name << ARGS_DECL << " {\n" << body << "}\n";
+                    if (i < LEAVES) leafInts.push_back(name);
+                    break;
+                case 1:
+                    name = "f" + to_string(i);
+                    body = prologue(depth) + "    WIGGLY r = " + floatExpr(depth) + ";\n    YEET r;\n";
+                    src << "WIGGLY " << name << ARGS_DECL << " {\n" << body << "}\n";
+                    if (i < LEAVES) leafFloats.push_back(name);
+                    break;
+                case 2:
+                    name = "s" + to_string(i);
+                    body = prologue(depth) + "    YEET " + strExpr(depth) + ";\n";
+                    src << "YAP " << name << ARGS_DECL << " {\n" << body << "}\n";
+                    if (i < LEAVES) leafStrings.push_back(name);
+                    break;
+                case 3:
+                    name = "b" + to_string(i);
+                    body = prologue(depth) + "    TRUTHMODE r = " + boolExpr(depth) + ";\n    YEET r;\n";
+                    src << "TRUTHMODE " << name << ARGS_DECL << " {\n" << body << "}\n";
+                    if (i < LEAVES) leafBools.push_back(name);
+                    break;
+                case 4:
+                    name = "v" + to_string(i);
+                    body = prologue(depth) + shout(depth) + (chance(2) ? "    YEET;\n" : "");
+                    src << "BLACK " << name << ARGS_DECL << " {\n" << body << "}\n";
+                    if (i < LEAVES) leafVoids.push_back(name);
+                    break;
+                case 5:
+                    name = "c" + to_string(i);
+                    body = prologue(depth) + "    YEET p;\n";
+                    src << "Pt " << name << ARGS_DECL << " {\n" << body << "}\n";
+                    if (i < LEAVES) leafClasses.push_back(name);
+                    break;
+                default:
+                    // Declared BOI but YEETs an object: the value keeps its class type
+                    name = "m" + to_string(i);
+                    body = prologue(depth) + "    YEET p;\n";
+                    src << "BOI " << name << ARGS_DECL << " {\n" << body << "}\n";
+                    break;
+            }
+            functionNames.push_back(name);
+            if (i == LEAVES - 1) {
+                ints = leafInts; floats = leafFloats; strings = leafStrings;
+                bools = leafBools; voids = leafVoids; classes = leafClasses;
+            }
+        }
+        for (int i = 0; i < 3; i++) shadowing(functions + i);
+        return src.str();
+    }
+};
+
+static bool sameValue(const WrapperValue& a, const WrapperValue& b) {
+    bool sameFloat = a.floatVal == b.floatVal || (isnan(a.floatVal) && isnan(b.floatVal));
+    return a.type == b.type && a.intVal == b.intVal && sameFloat &&
+           a.strVal == b.strVal && a.boolVal == b.boolVal && a.isReturn == b.isReturn;
+}
+
+static string describe(const WrapperValue& v) {
+    ostringstream os;
+    os << "{" << v.type << ", int " << v.intVal << ", float " << v.floatVal
+       << ", str \"" << v.strVal << "\", bool " << v.boolVal << "}";
+    return os.str();
+}
+
+// Runs every function on a few inputs with both walkers; returns number of values compared
+static long checkEquivalence(unsigned seed, int functions, int depth, bool& ok) {
+    EquivalenceGen gen(seed);
+    string source = gen.generate(functions, depth);
+
+    // Separate engines: class fields live in the class scope and persist between calls
+    KubEngine tree, flat;
+    flat.setFlatAST(true);
+    if (!tree.compile(source) || !flat.compile(source)) {
+        printf("equivalence program failed to compile: %s\n", tree.lastError().c_str());
+        ok = false;
+        return 0;
+    }
+
+    vector<WrapperValue> inputs[] = {
+        { WrapperValue::createInt(3), WrapperValue::createFloat(1.5f), WrapperValue::createString("hey"), WrapperValue::createBool(true) },
+        { WrapperValue::createInt(0), WrapperValue::createFloat(0.0f), WrapperValue::createString(""), WrapperValue::createBool(false) },
+        { WrapperValue::createInt(41), WrapperValue::createFloat(7.25f), WrapperValue::createString("kub"), WrapperValue::createBool(false) },
+    };
+
+    long compared = 0;
+    for (const string& name : gen.functionNames) {
+        for (auto& args : inputs) {
+            ostringstream treeOut, flatOut;
+            auto* oldOut = cout.rdbuf(treeOut.rdbuf());
+            auto* oldErr = cerr.rdbuf(treeOut.rdbuf());
+            WrapperValue a = tree.call(name, args);
+            cout.rdbuf(flatOut.rdbuf());
+            cerr.rdbuf(flatOut.rdbuf());
+            WrapperValue b = flat.call(name, args);
+            cout.rdbuf(oldOut);
+            cerr.rdbuf(oldErr);
+            compared++;
+
+            if (!sameValue(a, b) || treeOut.str() != flatOut.str()) {
+                printf("MISMATCH in %s (seed %u)\n  tree: %s\n  flat: %s\n", name.c_str(), seed,
+                       describe(a).c_str(), describe(b).c_str());
+                if (treeOut.str() != flatOut.str()) {
+                    printf("  tree output:\n%s  flat output:\n%s", treeOut.str().c_str(), flatOut.str().c_str());
+                }
+                ok = false;
+                return compared;
+            }
+        }
+    }
+    return compared;
+}
+
+// ---------------------------------------------------------------------------
+// Footprint and speed: one big function plus a few small helpers it calls
+// ---------------------------------------------------------------------------
+
+// Random expression over literals, parameters and earlier locals
+static string genIntExpr(mt19937& rng, int depth, int locals) {
+    if (depth == 0 || rng() % 4 == 0) {
+        int pick = rng() % 3;
+        if (pick == 0) return to_string(rng() % 10);
+        if (pick == 1 || locals == 0) return "x";
+        return "t" + to_string(rng() % locals);
+    }
+    string l = genIntExpr(rng, depth - 1, locals);
+    switch (rng() % 4) {
+        case 0: return "(" + l + " + " + genIntExpr(rng, depth - 1, locals) + ")";
+        case 1: return "(" + l + " - " + genIntExpr(rng, depth - 1, locals) + ")";
+        case 2: return "(" + l + " / " + to_string(rng() % 9 + 1) + ")";
+        default: return "(" + to_string(rng() % 3) + " * " + l + ")";
+    }
+}
+
+static string genFloatExpr(mt19937& rng, int depth) {
+    if (depth == 0 || rng() % 4 == 0) {
+        if (rng() % 2) return "y";
+        return to_string(rng() % 10) + ".5";
+    }
+    string l = genFloatExpr(rng, depth - 1);
+    string r = genFloatExpr(rng, depth - 1);
+    switch (rng() % 3) {
+        case 0: return "(" + l + " + " + r + ")";
+        case 1: return "(" + l + " - " + r + ")";
+        default: return "(" + l + " * 0.5)";
+    }
+}
+
+static string genProgram(int statements, int depth, unsigned seed) {
+    mt19937 rng(seed);
+    ostringstream src;
+    src << "BOI helper(BOI a, BOI b) { YEET (a + b) / 2; }\n";
+    src << "TRUTHMODE inRange(BOI v) { YEET v > 0 && v < 1000; }\n";
+    src << "BOI big(BOI x, WIGGLY y) {\n";
+    int ints = 0;
+    for (int i = 0; i < statements; i++) {
+        int kind = rng() % 10;
+        if (kind < 6) {
+            src << "    BOI t" << ints << " = " << genIntExpr(rng, depth, ints) << ";\n";
+            ints++;
+        } else if (kind < 8) {
+            src << "    WIGGLY f" << i << " = " << genFloatExpr(rng, depth) << ";\n";
+        } else if (kind < 9) {
+            src << "    TRUTHMODE b" << i << " = inRange(" << genIntExpr(rng, depth, ints) << ") || "
+                << genIntExpr(rng, depth, ints) << " == " << genIntExpr(rng, depth, ints) << ";\n";
+        } else {
+            src << "    BOI t" << ints << " = helper(" << genIntExpr(rng, depth, ints) << ", x);\n";
+            ints++;
+        }
+    }
+    src << "    YEET " << (ints ? "t" + to_string(ints - 1) : "x") << ";\n";
+    src << "}\n";
+    return src.str();
+}
+
+static double timeCalls(KubEngine& kub, int calls, long& checksum) {
+    const KubFunction* big = kub.function("big");
+    auto start = chrono::steady_clock::now();
+    for (int i = 0; i < calls; i++) {
+        WrapperValue r = kub.call(big, i, 1.25f);
+        checksum += r.intVal;
+    }
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double, micro>(end - start).count() / calls;
+}
+
+int main() {
+    // 1. Both walkers must agree on every value and every line of output
+    bool ok = true;
+    long compared = 0;
+    for (unsigned seed = 1; seed <= 20 && ok; seed++) {
+        compared += checkEquivalence(seed, 40, 4, ok);
+    }
+    if (!ok) return 1;
+    printf("equivalence: %ld calls compared (type, all fields, SHOUT/error output), all identical\n\n", compared);
+
+    // 2. Footprint and speed. Each mode is warmed up, then the modes alternate
+    //    for several rounds and the best round of each is reported.
+    struct Case { int statements; int depth; int calls; };
+    Case cases[] = { {1000, 4, 100}, {5000, 6, 20}, {20000, 6, 5} };
+    const int ROUNDS = 5;
+
+    printf("%-18s %10s %12s %12s %10s %12s %12s %8s\n",
+           "program", "nodes", "tree bytes", "flat bytes", "tree allocs", "tree us/call", "flat us/call", "speedup");
+
+    for (const Case& c : cases) {
+        string source = genProgram(c.statements, c.depth, 42);
+
+        KubEngine kub;
+        if (!kub.compile(source)) {
+            printf("compile failed: %s\n", kub.lastError().c_str());
+            return 1;
+        }
+        kub.setFlatAST(true);
+        const FlatStats& stats = kub.flatProgram().getStats();
+
+        long treeSum = 0, flatSum = 0, warm = 0;
+        kub.setFlatAST(false);
+        timeCalls(kub, 1, warm);
+        kub.setFlatAST(true);
+        timeCalls(kub, 1, warm);
+
+        double treeUs = 1e300, flatUs = 1e300;
+        for (int round = 0; round < ROUNDS; round++) {
+            kub.setFlatAST(false);
+            treeUs = min(treeUs, timeCalls(kub, c.calls, treeSum));
+            kub.setFlatAST(true);
+            flatUs = min(flatUs, timeCalls(kub, c.calls, flatSum));
+        }
+
+        if (treeSum != flatSum) {
+            printf("MISMATCH: tree checksum %ld, flat checksum %ld\n", treeSum, flatSum);
+            return 1;
+        }
+
+        char name[32];
+        snprintf(name, sizeof(name), "%d stmts, d=%d", c.statements, c.depth);
+        printf("%-18s %10zu %12zu %12zu %10zu %12.1f %12.1f %7.2fx\n",
+               name, stats.treeNodes, stats.treeBytes, stats.flatBytes, stats.treeAllocs,
+               treeUs, flatUs, treeUs / flatUs);
+    }
+    return 0;
+}
@@ -2,7 +2,7 @@
 
 #Curatenie
 echo "Cleaning up..."
-rm -f lex.yy.c limbaj.tab.c limbaj.tab.h compilator
+rm -f lex.yy.c limbaj.tab.c limbaj.tab.h compilator limbaj.o lex.o libkub.a
 
 #Generam codul C cu Bison
 echo "Compiling Bison..."
@@ -16,6 +16,12 @@ flex limbaj.l
 echo "Compiling C++..."
 g++ limbaj.tab.c lex.yy.c -o compilator
 
+#Biblioteca pentru embedding (Engine.h), fara main()
+echo "Building libkub.a..."
+g++ -c -DKUB_NO_MAIN limbaj.tab.c -o limbaj.o
+g++ -c lex.yy.c -o lex.o
+ar rcs libkub.a limbaj.o lex.o
+
 #Rulam doar daca s-a creat executabilul
 if [ -f "./compilator" ]; then
     echo "Compilation finished. Running..."
@@ -14,6 +14,9 @@
     SymbolTableManager* manager;
 
     bool hasErrors = false;
+
+    // When set (by KubEngine::compile), errors are collected here instead of printed
+    std::vector<std::string>* errorLog = nullptr;
 %}
 
 %code requires {
@@ -69,6 +72,7 @@
 %%
 
 program: global_declarations main_block
+       | global_declarations /* no THE_OP: library mode (see Engine.h) */
        ;
        
 global_declarations: global_declarations global_decl
@@ -609,9 +613,14 @@ expression: expression '+' expression
 
 void yyerror(const char* s) {
     hasErrors = true;
+    if (errorLog) {
+        errorLog->push_back(s);
+        return;
+    }
     std::cerr << "CRINGE ERROR (Syntax): " << s << std::endl;
 }
 
+#ifndef KUB_NO_MAIN
 int main(int argc, char** argv) {
     FILE *myfile = fopen("input.txt", "r");
     if (!myfile) {
@@ -627,18 +636,9 @@ int main(int argc, char** argv) {
         std::cout << "--------------------------------------" << std::endl;
         std::cout << "CRINGE: Programul contine erori si nu poate fi executat!" << std::endl;
 
-        // Clean up function bodies (done here where ASTNode is fully defined)
-    for (auto* body : manager->getFuncBodies()) {
-        if (body) {
-            for (auto* node : *body) {
-                delete node;
-            }
-            delete body;
-        }
-    }
-
-    delete manager;
-    fclose(myfile);
+        freeFunctionBodies(manager);
+        delete manager;
+        fclose(myfile);
     
         /* Oprim totul aici */
         return 0; 
@@ -648,18 +648,10 @@ int main(int argc, char** argv) {
     std::cout << "GIGACHAD: Parsare completa cu succes! Generez tables.txt ..." << std::endl;
     manager->printAllTables("tables.txt");
 
-    // Clean up function bodies (done here where ASTNode is fully defined)
-    for (auto* body : manager->getFuncBodies()) {
-        if (body) {
-            for (auto* node : *body) {
-                delete node;
-            }
-            delete body;
-        }
-    }
-
+    freeFunctionBodies(manager);
     delete manager;
     fclose(myfile);
     return 0;
     }
-}
\ No newline at end of file
+}
+#endif